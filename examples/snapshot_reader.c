@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <signal.h>
+#include "snapshot.h"
+
+// Minimal libanalyzer consumer: attach to the analyzer's shared-memory
+// snapshot and print the top-K riskiest processes once per second.
+// Re-attaches when the analyzer stops or restarts.
+// Usage: snapshot_reader [k] [name]
+
+volatile sig_atomic_t running = 1;
+
+void signal_handler(int sig) {
+    if (sig == SIGINT || sig == SIGTERM) {
+        running = 0;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int k = argc > 1 ? atoi(argv[1]) : 5;
+    const char *name = argc > 2 ? argv[2] : ANALYZER_SNAPSHOT_DEFAULT_NAME;
+
+    if (k <= 0 || k > ANALYZER_SNAPSHOT_MAX_ENTRIES) k = 5;
+
+    signal(SIGINT, signal_handler);
+    signal(SIGTERM, signal_handler);
+
+    const AnalyzerSnapshot *snapshot = NULL;
+    AnalyzerSnapshotEntry top[ANALYZER_SNAPSHOT_MAX_ENTRIES];
+    uint64_t last_cycle = 0;
+    int waiting_shown = 0;
+
+    while (running) {
+        // A stale mapping (writer exited, crashed or was replaced) never
+        // updates again, so drop it and look the name up afresh
+        if (snapshot && !analyzer_snapshot_is_live(snapshot, ANALYZER_SNAPSHOT_STALE_SECONDS)) {
+            printf("\n⚠️  Snapshot %s is stale, waiting for the analyzer...\n", name);
+            fflush(stdout);
+            analyzer_snapshot_detach(snapshot);
+            snapshot = NULL;
+            waiting_shown = 1;
+        }
+
+        if (!snapshot) {
+            snapshot = analyzer_snapshot_attach(name);
+            if (snapshot && !analyzer_snapshot_is_live(snapshot, ANALYZER_SNAPSHOT_STALE_SECONDS)) {
+                analyzer_snapshot_detach(snapshot);
+                snapshot = NULL;
+            }
+            if (!snapshot) {
+                if (!waiting_shown) {
+                    printf("⏳ Waiting for performance_analyzer to publish %s...\n", name);
+                    fflush(stdout);
+                    waiting_shown = 1;
+                }
+                sleep(1);
+                continue;
+            }
+            waiting_shown = 0;
+            last_cycle = 0;
+        }
+
+        uint64_t cycle = 0;
+        int count = analyzer_snapshot_top(snapshot, top, k, &cycle);
+
+        if (count < 0) {
+            // Writer stopped mid-update; the liveness check above handles it
+            sleep(1);
+            continue;
+        }
+
+        if (cycle != last_cycle) {
+            printf("\n🔍 Cycle #%llu - top %d by risk\n", (unsigned long long)cycle, count);
+            for (int i = 0; i < count; i++) {
+                printf("   %-6d %-20.20s CPU %5.1f%%  MEM %8.1f MB  Risk %5.1f  %s\n",
+                       top[i].pid, top[i].name, top[i].cpu_usage, top[i].memory_mb,
+                       top[i].risk_score, top[i].bottleneck);
+            }
+            fflush(stdout);
+            last_cycle = cycle;
+        }
+
+        sleep(1);
+    }
+
+    analyzer_snapshot_detach(snapshot);
+    return 0;
+}
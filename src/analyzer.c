@@ -21,6 +21,38 @@ static int track_count = 0;
 static long prev_total_cpu = 0;
 static long prev_idle_cpu = 0;
 
+// Active process filter (NULL = accept everything)
+static const ProcessFilter *active_filter = NULL;
+
+void set_process_filter(const ProcessFilter *filter) {
+    active_filter = filter;
+}
+
+// Read the cgroup path of a process, preferring the unified (v2) hierarchy
+static void read_process_cgroup(int pid, char *buffer, int size) {
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/%d/cgroup", pid);
+    buffer[0] = '\0';
+
+    FILE *fp = fopen(path, "r");
+    if (!fp) return;
+
+    char line[512];
+    while (fgets(line, sizeof(line), fp)) {
+        char *cgroup_path = strchr(line, ':');
+        if (cgroup_path) cgroup_path = strchr(cgroup_path + 1, ':');
+        if (!cgroup_path) continue;
+
+        trim_string(cgroup_path + 1);
+        if (buffer[0] == '\0' || strncmp(line, "0::", 3) == 0) {
+            strncpy(buffer, cgroup_path + 1, size - 1);
+            buffer[size - 1] = '\0';
+        }
+        if (strncmp(line, "0::", 3) == 0) break;
+    }
+    fclose(fp);
+}
+
 int get_process_count() {
     DIR *dir = opendir("/proc");
     if (!dir) return 0;
@@ -153,7 +185,7 @@ float calculate_process_cpu_usage(int pid, unsigned long utime, unsigned long st
 
 int collect_processes(ProcessInfo *processes, int max_count) {
     DIR *dir = opendir("/proc");
-    if (!dir) return 0;
+    if (!dir) return -1;
     
     int count = 0;
     struct dirent *entry;
@@ -176,6 +208,12 @@ int collect_processes(ProcessInfo *processes, int max_count) {
         int pid = atoi(entry->d_name);
         if (pid <= 0) continue;
         
+        // Tiered filtering: each check runs as soon as its fields are known,
+        // so rejected PIDs skip the remaining file opens
+        FilterSubject subject = { &processes[count], (uid_t)-1, NULL };
+        processes[count].pid = pid;
+        if (!filter_eval_tier(active_filter, FILTER_TIER_PID, &subject)) continue;
+        
         char path[256];
         snprintf(path, sizeof(path), "/proc/%d/stat", pid);
         
@@ -215,6 +253,12 @@ int collect_processes(ProcessInfo *processes, int max_count) {
                 // Calculate actual CPU usage
                 processes[count].cpu_usage = calculate_process_cpu_usage(pid, utime, stime);
                 
+                // Filter on the measured value, before the demo fallback below
+                if (!filter_eval_tier(active_filter, FILTER_TIER_STAT, &subject)) {
+                    fclose(fp);
+                    continue;
+                }
+                
                 // If calculation fails, use system CPU as reference with random factor
                 if (processes[count].cpu_usage == 0.0f && count < 10) {
                     // For demo purposes, show some activity
@@ -227,6 +271,17 @@ int collect_processes(ProcessInfo *processes, int max_count) {
                 processes[count].threads = 1;
                 processes[count].priority = 0;
                 
+                if (filter_needs_tier(active_filter, FILTER_TIER_CGROUP)) {
+                    char cgroup[MAX_CGROUP_LEN];
+                    read_process_cgroup(pid, cgroup, sizeof(cgroup));
+                    subject.cgroup = cgroup;
+                    if (!filter_eval_tier(active_filter, FILTER_TIER_CGROUP, &subject)) {
+                        fclose(fp);
+                        continue;
+                    }
+                    subject.cgroup = NULL;
+                }
+                
                 // Get memory info from status file
                 snprintf(path, sizeof(path), "/proc/%d/status", pid);
                 FILE *status_fp = fopen(path, "r");
@@ -240,6 +295,12 @@ int collect_processes(ProcessInfo *processes, int max_count) {
                             }
                         } else if (strstr(line, "Threads:")) {
                             sscanf(line, "Threads: %d", &processes[count].threads);
+                        } else if (strncmp(line, "Uid:", 4) == 0) {
+                            // First column is the real uid
+                            unsigned long uid;
+                            if (sscanf(line, "Uid: %lu", &uid) == 1) {
+                                subject.uid = (uid_t)uid;
+                            }
                         } else if (strstr(line, "Priority:")) {
                             sscanf(line, "Priority: %d", &processes[count].priority);
                         }
@@ -247,7 +308,9 @@ int collect_processes(ProcessInfo *processes, int max_count) {
                     fclose(status_fp);
                 }
                 
-                count++;
+                if (filter_eval_tier(active_filter, FILTER_TIER_STATUS, &subject)) {
+                    count++;
+                }
             }
             fclose(fp);
         }
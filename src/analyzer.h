@@ -2,12 +2,15 @@
 #define ANALYZER_H
 
 #include "utils.h"
+#include "filter.h"
+#include "snapshot.h"
 
 // Data collection functions
 int get_process_count();
-int collect_processes(ProcessInfo *processes, int max_count);
+int collect_processes(ProcessInfo *processes, int max_count);  // -1 if /proc is unreadable
 float get_cpu_usage();
 float get_memory_usage();
+void set_process_filter(const ProcessFilter *filter);
 
 // AI Analysis functions
 void analyze_process(ProcessInfo *proc, ProcessAnalysis *analysis);
@@ -15,6 +18,11 @@ void detect_anomalies(ProcessInfo *processes, int count);
 void predict_trends(ProcessInfo *processes, int count);
 void generate_recommendations(ProcessAnalysis *analysis);
 
+// Snapshot publishing (readers use the API in snapshot.h)
+int analyzer_snapshot_create(const char *name);
+void analyzer_snapshot_publish(const ProcessInfo *processes, const ProcessAnalysis *analysis, int count, int cycle);
+void analyzer_snapshot_destroy();
+
 // Display functions
 void display_dashboard(ProcessInfo *processes, ProcessAnalysis *analysis, int count);
 void show_detailed_view(ProcessInfo *proc, ProcessAnalysis *analysis);
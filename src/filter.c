@@ -0,0 +1,250 @@
+#include "filter.h"
+#include <ctype.h>
+#include <errno.h>
+#include <fnmatch.h>
+#include <pwd.h>
+
+typedef enum {
+    KIND_INTEGER,
+    KIND_NUMBER,
+    KIND_TEXT
+} FieldKind;
+
+typedef struct {
+    const char *name;
+    FilterField field;
+    FilterTier tier;
+    FieldKind kind;
+} FieldSpec;
+
+static const FieldSpec field_specs[] = {
+    { "pid",      FIELD_PID,      FILTER_TIER_PID,    KIND_INTEGER },
+    { "uid",      FIELD_UID,      FILTER_TIER_STATUS, KIND_INTEGER },
+    { "user",     FIELD_UID,      FILTER_TIER_STATUS, KIND_INTEGER },
+    { "name",     FIELD_NAME,     FILTER_TIER_STAT,   KIND_TEXT },
+    { "state",    FIELD_STATE,    FILTER_TIER_STAT,   KIND_TEXT },
+    { "cpu",      FIELD_CPU,      FILTER_TIER_STAT,   KIND_NUMBER },
+    { "cgroup",   FIELD_CGROUP,   FILTER_TIER_CGROUP, KIND_TEXT },
+    { "rss",      FIELD_RSS,      FILTER_TIER_STATUS, KIND_NUMBER },
+    { "threads",  FIELD_THREADS,  FILTER_TIER_STATUS, KIND_INTEGER },
+    { "priority", FIELD_PRIORITY, FILTER_TIER_STATUS, KIND_INTEGER },
+};
+
+#define FIELD_SPEC_COUNT (int)(sizeof(field_specs) / sizeof(field_specs[0]))
+
+static const char *parse_op(const char *p, FilterOp *op) {
+    if (strncmp(p, "==", 2) == 0) { *op = OP_EQ; return p + 2; }
+    if (strncmp(p, "!=", 2) == 0) { *op = OP_NE; return p + 2; }
+    if (strncmp(p, ">=", 2) == 0) { *op = OP_GE; return p + 2; }
+    if (strncmp(p, "<=", 2) == 0) { *op = OP_LE; return p + 2; }
+    if (*p == '=') { *op = OP_EQ; return p + 1; }
+    if (*p == '>') { *op = OP_GT; return p + 1; }
+    if (*p == '<') { *op = OP_LT; return p + 1; }
+    if (*p == '~') { *op = OP_MATCH; return p + 1; }
+    return NULL;
+}
+
+int filter_compile(const char *expr, ProcessFilter *filter, char *err, int err_size) {
+    memset(filter, 0, sizeof(*filter));
+    if (!expr) return 0;
+
+    FilterPredicate parsed[MAX_FILTER_PREDICATES];
+    FilterTier tiers[MAX_FILTER_PREDICATES];
+    int count = 0;
+    const char *p = expr;
+
+    while (*p) {
+        while (isspace((unsigned char)*p)) p++;
+        if (!*p) break;
+
+        if (count == MAX_FILTER_PREDICATES) {
+            snprintf(err, err_size, "too many predicates (max %d)", MAX_FILTER_PREDICATES);
+            return -1;
+        }
+
+        // Field name
+        char field_name[32];
+        int len = 0;
+        while (isalpha((unsigned char)*p) && len < (int)sizeof(field_name) - 1) {
+            field_name[len++] = *p++;
+        }
+        field_name[len] = '\0';
+
+        const FieldSpec *spec = NULL;
+        for (int i = 0; i < FIELD_SPEC_COUNT; i++) {
+            if (strcmp(field_specs[i].name, field_name) == 0) {
+                spec = &field_specs[i];
+                break;
+            }
+        }
+        if (!spec) {
+            snprintf(err, err_size, "unknown field '%s'", field_name);
+            return -1;
+        }
+
+        // Operator
+        while (isspace((unsigned char)*p)) p++;
+        FilterPredicate *pred = &parsed[count];
+        memset(pred, 0, sizeof(*pred));
+        pred->field = spec->field;
+        p = parse_op(p, &pred->op);
+        if (!p) {
+            snprintf(err, err_size, "missing operator after '%s'", field_name);
+            return -1;
+        }
+
+        // Value: quoted string or a bare word up to whitespace or '&'
+        while (isspace((unsigned char)*p)) p++;
+        char value[MAX_FILTER_VALUE_LEN];
+        len = 0;
+        if (*p == '"' || *p == '\'') {
+            char quote = *p++;
+            while (*p && *p != quote && len < MAX_FILTER_VALUE_LEN - 1) value[len++] = *p++;
+            if (*p != quote) {
+                snprintf(err, err_size, "unterminated value for '%s'", field_name);
+                return -1;
+            }
+            p++;
+        } else {
+            while (*p && !isspace((unsigned char)*p) && *p != '&' && len < MAX_FILTER_VALUE_LEN - 1) {
+                value[len++] = *p++;
+            }
+        }
+        value[len] = '\0';
+        if (len == 0) {
+            snprintf(err, err_size, "missing value for '%s'", field_name);
+            return -1;
+        }
+
+        if (spec->kind == KIND_TEXT) {
+            if (pred->op != OP_EQ && pred->op != OP_NE && pred->op != OP_MATCH) {
+                snprintf(err, err_size, "'%s' only supports ==, != and ~", field_name);
+                return -1;
+            }
+            strcpy(pred->text, value);
+        } else {
+            if (pred->op == OP_MATCH) {
+                snprintf(err, err_size, "'%s' does not support ~", field_name);
+                return -1;
+            }
+            char *end;
+            errno = 0;
+            if (spec->kind == KIND_INTEGER) {
+                pred->integer = strtoll(value, &end, 10);
+            } else {
+                pred->number = strtof(value, &end);
+            }
+            if (errno == ERANGE) {
+                snprintf(err, err_size, "invalid value '%s' for '%s'", value, field_name);
+                return -1;
+            }
+            if (*end != '\0') {
+                // user==name resolves to a uid once, here, not per PID
+                struct passwd *pw = strcmp(spec->name, "user") == 0 ? getpwnam(value) : NULL;
+                if (!pw) {
+                    snprintf(err, err_size, "invalid value '%s' for '%s'", value, field_name);
+                    return -1;
+                }
+                pred->integer = pw->pw_uid;
+            }
+        }
+
+        tiers[count] = spec->tier;
+        count++;
+
+        // Separator
+        while (isspace((unsigned char)*p)) p++;
+        if (*p == '\0') break;
+        if (strncmp(p, "&&", 2) != 0) {
+            snprintf(err, err_size, "expected '&&' near '%s'", p);
+            return -1;
+        }
+        p += 2;
+        while (isspace((unsigned char)*p)) p++;
+        if (*p == '\0') {
+            snprintf(err, err_size, "trailing '&&'");
+            return -1;
+        }
+    }
+
+    // Flatten into tier order
+    for (int tier = 0; tier < FILTER_TIER_COUNT; tier++) {
+        filter->tier_start[tier] = filter->count;
+        for (int i = 0; i < count; i++) {
+            if (tiers[i] == (FilterTier)tier) {
+                filter->predicates[filter->count++] = parsed[i];
+            }
+        }
+    }
+    filter->tier_start[FILTER_TIER_COUNT] = filter->count;
+
+    return 0;
+}
+
+bool filter_needs_tier(const ProcessFilter *filter, FilterTier tier) {
+    if (!filter) return false;
+    return filter->tier_start[tier + 1] > filter->tier_start[tier];
+}
+
+static bool compare_integer(FilterOp op, long long actual, long long expected) {
+    switch (op) {
+        case OP_EQ: return actual == expected;
+        case OP_NE: return actual != expected;
+        case OP_LT: return actual < expected;
+        case OP_LE: return actual <= expected;
+        case OP_GT: return actual > expected;
+        case OP_GE: return actual >= expected;
+        default:    return false;
+    }
+}
+
+static bool compare_number(FilterOp op, float actual, float expected) {
+    switch (op) {
+        case OP_EQ: return actual == expected;
+        case OP_NE: return actual != expected;
+        case OP_LT: return actual < expected;
+        case OP_LE: return actual <= expected;
+        case OP_GT: return actual > expected;
+        case OP_GE: return actual >= expected;
+        default:    return false;
+    }
+}
+
+static bool compare_text(FilterOp op, const char *actual, const char *expected) {
+    switch (op) {
+        case OP_EQ:    return strcmp(actual, expected) == 0;
+        case OP_NE:    return strcmp(actual, expected) != 0;
+        case OP_MATCH: return fnmatch(expected, actual, 0) == 0;
+        default:       return false;
+    }
+}
+
+static bool eval_predicate(const FilterPredicate *pred, const FilterSubject *subject) {
+    const ProcessInfo *proc = subject->proc;
+
+    switch (pred->field) {
+        case FIELD_PID:      return compare_integer(pred->op, proc->pid, pred->integer);
+        case FIELD_UID:      return compare_integer(pred->op, subject->uid, pred->integer);
+        case FIELD_NAME:     return compare_text(pred->op, proc->name, pred->text);
+        case FIELD_CPU:      return compare_number(pred->op, proc->cpu_usage, pred->number);
+        case FIELD_RSS:      return compare_number(pred->op, proc->memory_mb, pred->number);
+        case FIELD_THREADS:  return compare_integer(pred->op, proc->threads, pred->integer);
+        case FIELD_PRIORITY: return compare_integer(pred->op, proc->priority, pred->integer);
+        case FIELD_STATE: {
+            char state[2] = { proc->state, '\0' };
+            return compare_text(pred->op, state, pred->text);
+        }
+        case FIELD_CGROUP:
+            return compare_text(pred->op, subject->cgroup ? subject->cgroup : "", pred->text);
+    }
+    return false;
+}
+
+bool filter_eval_tier(const ProcessFilter *filter, FilterTier tier, const FilterSubject *subject) {
+    if (!filter) return true;
+
+    for (int i = filter->tier_start[tier]; i < filter->tier_start[tier + 1]; i++) {
+        if (!eval_predicate(&filter->predicates[i], subject)) return false;
+    }
+    return true;
+}
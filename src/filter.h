@@ -0,0 +1,71 @@
+#ifndef FILTER_H
+#define FILTER_H
+
+#include <sys/types.h>
+#include "utils.h"
+
+#define MAX_FILTER_PREDICATES 16
+#define MAX_FILTER_VALUE_LEN 128
+#define MAX_CGROUP_LEN 256
+
+// Scan tiers, ordered by cost. Each predicate runs at the first tier
+// where its field is known, so a rejected PID skips every later read.
+typedef enum {
+    FILTER_TIER_PID = 0,    // directory name only, no syscalls
+    FILTER_TIER_STAT,       // /proc/<pid>/stat
+    FILTER_TIER_CGROUP,     // /proc/<pid>/cgroup
+    FILTER_TIER_STATUS,     // /proc/<pid>/status (rss, threads, real uid)
+    FILTER_TIER_COUNT
+} FilterTier;
+
+typedef enum {
+    FIELD_PID,
+    FIELD_UID,
+    FIELD_NAME,
+    FIELD_STATE,
+    FIELD_CPU,
+    FIELD_CGROUP,
+    FIELD_RSS,
+    FIELD_THREADS,
+    FIELD_PRIORITY
+} FilterField;
+
+typedef enum {
+    OP_EQ,
+    OP_NE,
+    OP_LT,
+    OP_LE,
+    OP_GT,
+    OP_GE,
+    OP_MATCH    // glob match, e.g. name~ssh*
+} FilterOp;
+
+typedef struct {
+    FilterField field;
+    FilterOp op;
+    long long integer;  // pid, uid, threads, priority
+    float number;       // cpu, rss
+    char text[MAX_FILTER_VALUE_LEN];
+} FilterPredicate;
+
+// Compiled filter: predicates AND-ed together and sorted by tier.
+// Predicates for tier t live in [tier_start[t], tier_start[t + 1]).
+typedef struct {
+    int count;
+    int tier_start[FILTER_TIER_COUNT + 1];
+    FilterPredicate predicates[MAX_FILTER_PREDICATES];
+} ProcessFilter;
+
+// Fields gathered so far for the PID being scanned
+typedef struct {
+    const ProcessInfo *proc;
+    uid_t uid;
+    const char *cgroup;
+} FilterSubject;
+
+// Filter functions
+int filter_compile(const char *expr, ProcessFilter *filter, char *err, int err_size);
+bool filter_needs_tier(const ProcessFilter *filter, FilterTier tier);
+bool filter_eval_tier(const ProcessFilter *filter, FilterTier tier, const FilterSubject *subject);
+
+#endif
@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <errno.h>
 #include <unistd.h>
 #include <signal.h>
 #include <time.h>
@@ -8,11 +10,12 @@
 
 #define MAX_PROCESSES 256
 #define REFRESH_INTERVAL 3
+#define CONFIG_PATH "config/config.ini"
 
 volatile sig_atomic_t running = 1;
 
 void signal_handler(int sig) {
-    if (sig == SIGINT) {
+    if (sig == SIGINT || sig == SIGTERM) {
         running = 0;
         printf("\n\n🛑 Shutting down AI Performance Analyzer...\n");
     }
@@ -32,9 +35,58 @@ void print_welcome() {
     sleep(2);
 }
 
-int main() {
-    // Set up signal handler
+void print_usage(const char *prog) {
+    printf("Usage: %s [-f|--filter EXPR] [-c|--config PATH] [-s|--shm NAME]\n", prog);
+    printf("  EXPR example: \"user==root && name~ssh* && rss>50\"\n");
+    printf("  Fields: pid uid user name state cpu cgroup rss threads priority\n");
+    printf("  NAME: shared-memory snapshot name (default %s)\n", ANALYZER_SNAPSHOT_DEFAULT_NAME);
+}
+
+int main(int argc, char *argv[]) {
+    const char *config_path = CONFIG_PATH;
+    const char *filter_expr = NULL;
+    const char *shm_name = NULL;
+    
+    // Parse command line
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-f") == 0 || strcmp(argv[i], "--filter") == 0) && i + 1 < argc) {
+            filter_expr = argv[++i];
+        } else if ((strcmp(argv[i], "-c") == 0 || strcmp(argv[i], "--config") == 0) && i + 1 < argc) {
+            config_path = argv[++i];
+        } else if ((strcmp(argv[i], "-s") == 0 || strcmp(argv[i], "--shm") == 0) && i + 1 < argc) {
+            shm_name = argv[++i];
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    
+    // Command line filter overrides the config file
+    char config_filter[512];
+    if (!filter_expr && read_config_value(config_path, "filter", "expression", config_filter, sizeof(config_filter))) {
+        filter_expr = config_filter;
+    }
+    
+    ProcessFilter filter;
+    char filter_error[128];
+    if (filter_compile(filter_expr, &filter, filter_error, sizeof(filter_error)) != 0) {
+        printf("❌ Error: Invalid filter expression: %s\n", filter_error);
+        return 1;
+    }
+    if (filter.count > 0) {
+        set_process_filter(&filter);
+    }
+    
+    // Larger than any valid name so create() sees and rejects long ones
+    char config_shm[256];
+    if (!shm_name && read_config_value(config_path, "snapshot", "name", config_shm, sizeof(config_shm)) && config_shm[0]) {
+        shm_name = config_shm;
+    }
+    if (!shm_name) shm_name = ANALYZER_SNAPSHOT_DEFAULT_NAME;
+    
+    // Set up signal handlers
     signal(SIGINT, signal_handler);
+    signal(SIGTERM, signal_handler);
     
     // Seed random number generator
     srand(time(NULL));
@@ -42,6 +94,16 @@ int main() {
     // Print welcome message
     print_welcome();
     
+    if (filter.count > 0) {
+        printf("🔎 Process filter: %s\n\n", filter_expr);
+    }
+    
+    // Publish each cycle so other local tools can read it without rescanning /proc
+    if (analyzer_snapshot_create(shm_name) != 0) {
+        printf("⚠️  Could not create shared-memory snapshot %s (%s), continuing without it\n\n",
+               shm_name, strerror(errno));
+    }
+    
     ProcessInfo processes[MAX_PROCESSES];
     ProcessAnalysis analysis[MAX_PROCESSES];
     
@@ -60,6 +122,8 @@ int main() {
                 analyze_process(&processes[i], &analysis[i]);
             }
             
+            analyzer_snapshot_publish(processes, analysis, process_count, cycle);
+            
             // Display real-time dashboard
             display_dashboard(processes, analysis, process_count);
             
@@ -121,6 +185,11 @@ int main() {
             }
             
             printf("\n");
+        } else if (process_count == 0 && filter.count > 0) {
+            // A filter matching nothing right now is normal; keep watching
+            // and keep the snapshot heartbeat going with an empty cycle
+            analyzer_snapshot_publish(processes, analysis, 0, cycle);
+            printf("🔎 No processes match filter: %s\n\n", filter_expr);
         } else {
             printf("❌ Error: Could not collect process data!\n");
             printf("   Make sure you're running with sudo privileges.\n");
@@ -142,6 +211,8 @@ int main() {
     }
     
     // Shutdown sequence
+    analyzer_snapshot_destroy();
+    
     printf("\n════════════════════════════════════════════════════════════════════\n");
     printf("📊 Final Statistics:\n");
     printf("   • Total monitoring cycles: %d\n", cycle);
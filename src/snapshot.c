@@ -0,0 +1,200 @@
+#include "analyzer.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Writer state (one published segment per analyzer process)
+static AnalyzerSnapshot *published = NULL;
+static char published_name[ANALYZER_SNAPSHOT_SHM_NAME_MAX];
+static dev_t published_dev;
+static ino_t published_ino;
+static AnalyzerSnapshotEntry staging[ANALYZER_SNAPSHOT_MAX_ENTRIES];
+
+int analyzer_snapshot_create(const char *name) {
+    // Reject rather than truncate, or destroy would unlink the wrong name
+    if (strlen(name) >= sizeof(published_name)) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0 && errno == EEXIST) {
+        // Only replace a segment left behind by a writer that is gone
+        const AnalyzerSnapshot *existing = analyzer_snapshot_attach(name);
+        int live = analyzer_snapshot_is_live(existing, ANALYZER_SNAPSHOT_STALE_SECONDS);
+        analyzer_snapshot_detach(existing);
+        if (live) {
+            errno = EEXIST;
+            return -1;
+        }
+        shm_unlink(name);
+        fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    }
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || ftruncate(fd, sizeof(AnalyzerSnapshot)) != 0) {
+        close(fd);
+        shm_unlink(name);
+        return -1;
+    }
+
+    void *mem = mmap(NULL, sizeof(AnalyzerSnapshot), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        shm_unlink(name);
+        return -1;
+    }
+
+    published = mem;
+    published_dev = st.st_dev;
+    published_ino = st.st_ino;
+    strncpy(published_name, name, sizeof(published_name) - 1);
+    published_name[sizeof(published_name) - 1] = '\0';
+
+    // Readers see an empty snapshot until the first cycle lands
+    __atomic_store_n(&published->seq, 0, __ATOMIC_RELAXED);
+    published->version = ANALYZER_SNAPSHOT_VERSION;
+    published->count = 0;
+    published->writer_pid = getpid();
+    __atomic_store_n(&published->timestamp, (int64_t)time(NULL), __ATOMIC_RELAXED);
+    __atomic_store_n(&published->magic, ANALYZER_SNAPSHOT_MAGIC, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+static int compare_risk(const void *a, const void *b) {
+    float ra = ((const AnalyzerSnapshotEntry *)a)->risk_score;
+    float rb = ((const AnalyzerSnapshotEntry *)b)->risk_score;
+    return (rb > ra) - (rb < ra);
+}
+
+void analyzer_snapshot_publish(const ProcessInfo *processes, const ProcessAnalysis *analysis, int count, int cycle) {
+    if (!published) return;
+    if (count > ANALYZER_SNAPSHOT_MAX_ENTRIES) count = ANALYZER_SNAPSHOT_MAX_ENTRIES;
+
+    // Build and sort outside the critical section to keep the odd window short
+    for (int i = 0; i < count; i++) {
+        AnalyzerSnapshotEntry *entry = &staging[i];
+        entry->pid = processes[i].pid;
+        entry->threads = processes[i].threads;
+        entry->priority = processes[i].priority;
+        entry->cpu_usage = processes[i].cpu_usage;
+        entry->memory_mb = processes[i].memory_mb;
+        entry->risk_score = analysis[i].risk_score;
+        entry->state = processes[i].state;
+        strncpy(entry->name, processes[i].name, ANALYZER_SNAPSHOT_NAME_LEN - 1);
+        entry->name[ANALYZER_SNAPSHOT_NAME_LEN - 1] = '\0';
+        strncpy(entry->bottleneck, analysis[i].bottleneck, sizeof(entry->bottleneck) - 1);
+        entry->bottleneck[sizeof(entry->bottleneck) - 1] = '\0';
+        strncpy(entry->recommendation, analysis[i].recommendation, sizeof(entry->recommendation) - 1);
+        entry->recommendation[sizeof(entry->recommendation) - 1] = '\0';
+    }
+    qsort(staging, count, sizeof(AnalyzerSnapshotEntry), compare_risk);
+
+    uint32_t seq = __atomic_load_n(&published->seq, __ATOMIC_RELAXED);
+    if (seq % 2 == 0) seq++;
+    __atomic_store_n(&published->seq, seq, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memcpy(published->entries, staging, count * sizeof(AnalyzerSnapshotEntry));
+    published->count = count;
+    published->cycle = cycle;
+    __atomic_store_n(&published->timestamp, (int64_t)time(NULL), __ATOMIC_RELAXED);
+
+    __atomic_store_n(&published->seq, seq + 1, __ATOMIC_RELEASE);
+}
+
+void analyzer_snapshot_destroy() {
+    if (!published) return;
+
+    // Readers still mapping this segment see it as no longer live
+    __atomic_store_n(&published->writer_pid, 0, __ATOMIC_RELEASE);
+    munmap(published, sizeof(AnalyzerSnapshot));
+    published = NULL;
+
+    // Only unlink the name if it still refers to our segment; another
+    // analyzer may have replaced it after deciding we were gone
+    int fd = shm_open(published_name, O_RDONLY, 0);
+    if (fd < 0) return;
+
+    struct stat st;
+    int ours = fstat(fd, &st) == 0 && st.st_dev == published_dev && st.st_ino == published_ino;
+    close(fd);
+    if (ours) shm_unlink(published_name);
+}
+
+const AnalyzerSnapshot *analyzer_snapshot_attach(const char *name) {
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(AnalyzerSnapshot)) {
+        close(fd);
+        return NULL;
+    }
+
+    void *mem = mmap(NULL, sizeof(AnalyzerSnapshot), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) return NULL;
+
+    const AnalyzerSnapshot *snapshot = mem;
+    if (__atomic_load_n(&snapshot->magic, __ATOMIC_ACQUIRE) != ANALYZER_SNAPSHOT_MAGIC ||
+        snapshot->version != ANALYZER_SNAPSHOT_VERSION) {
+        munmap(mem, sizeof(AnalyzerSnapshot));
+        return NULL;
+    }
+
+    return snapshot;
+}
+
+void analyzer_snapshot_detach(const AnalyzerSnapshot *snapshot) {
+    if (snapshot) munmap((void *)snapshot, sizeof(AnalyzerSnapshot));
+}
+
+// Copy the k highest-risk entries into out, which must hold k entries.
+// Plain loads from the mapping, no syscalls. Returns -1 if no consistent
+// copy was possible, e.g. the writer died mid-update.
+int analyzer_snapshot_top(const AnalyzerSnapshot *snapshot, AnalyzerSnapshotEntry *out, int k, uint64_t *cycle) {
+    if (!snapshot || k <= 0) return 0;
+
+    int count = 0;
+    int retries = 0;
+    uint32_t before, after;
+    do {
+        if (retries++ == ANALYZER_SNAPSHOT_MAX_RETRIES) return -1;
+
+        before = __atomic_load_n(&snapshot->seq, __ATOMIC_ACQUIRE);
+        if (before % 2 != 0) continue;
+
+        // count comes from shared memory; never trust it past the array
+        count = snapshot->count;
+        if (count > ANALYZER_SNAPSHOT_MAX_ENTRIES) count = ANALYZER_SNAPSHOT_MAX_ENTRIES;
+        if (count > k) count = k;
+        if (count < 0) count = 0;
+        memcpy(out, snapshot->entries, count * sizeof(AnalyzerSnapshotEntry));
+        if (cycle) *cycle = snapshot->cycle;
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        after = __atomic_load_n(&snapshot->seq, __ATOMIC_RELAXED);
+    } while (before % 2 != 0 || before != after);
+
+    return count;
+}
+
+// Live = the writer has not shut down, its pid still exists and it has
+// published within max_age_seconds (0 skips the age check)
+int analyzer_snapshot_is_live(const AnalyzerSnapshot *snapshot, int max_age_seconds) {
+    if (!snapshot) return 0;
+
+    int32_t pid = __atomic_load_n(&snapshot->writer_pid, __ATOMIC_ACQUIRE);
+    if (pid <= 0) return 0;
+    if (kill(pid, 0) != 0 && errno != EPERM) return 0;
+
+    int64_t timestamp = __atomic_load_n(&snapshot->timestamp, __ATOMIC_RELAXED);
+    if (max_age_seconds > 0 && time(NULL) - timestamp > max_age_seconds) return 0;
+
+    return 1;
+}
@@ -0,0 +1,65 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+// Public libanalyzer API: a read-only view of the analyzer's latest cycle,
+// published in POSIX shared memory. Self-contained so other local tools can
+// include it without the rest of the analyzer headers.
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ANALYZER_SNAPSHOT_DEFAULT_NAME "/ai_performance_analyzer"
+#define ANALYZER_SNAPSHOT_MAGIC 0x41495041u   // "AIPA"
+#define ANALYZER_SNAPSHOT_VERSION 2
+#define ANALYZER_SNAPSHOT_MAX_ENTRIES 256
+#define ANALYZER_SNAPSHOT_NAME_LEN 128
+#define ANALYZER_SNAPSHOT_SHM_NAME_MAX 64      // shared-memory names must be shorter
+#define ANALYZER_SNAPSHOT_MAX_RETRIES (1 << 20)
+#define ANALYZER_SNAPSHOT_STALE_SECONDS 10     // no publish for this long = writer gone
+
+// One process, already analyzed. Layout is part of the stable API.
+typedef struct {
+    int32_t pid;
+    int32_t threads;
+    int32_t priority;
+    float cpu_usage;
+    float memory_mb;
+    float risk_score;
+    char state;
+    char name[ANALYZER_SNAPSHOT_NAME_LEN];
+    char bottleneck[32];
+    char recommendation[256];
+} AnalyzerSnapshotEntry;
+
+// Shared segment. The writer bumps seq to an odd value before updating and
+// back to even afterwards; readers retry until they see the same even value
+// on both sides of their copy, so they never block the writer.
+// One writer per name: the analyzer refuses to take over a segment whose
+// writer is still live, and clears writer_pid when it shuts down cleanly.
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t seq;
+    int32_t count;
+    uint64_t cycle;
+    int64_t timestamp;      // heartbeat: time of the last publish (or creation)
+    int32_t writer_pid;     // 0 once the writer has shut down
+    int32_t reserved;
+    AnalyzerSnapshotEntry entries[ANALYZER_SNAPSHOT_MAX_ENTRIES];  // sorted by risk, highest first
+} AnalyzerSnapshot;
+
+// Reader functions
+const AnalyzerSnapshot *analyzer_snapshot_attach(const char *name);
+void analyzer_snapshot_detach(const AnalyzerSnapshot *snapshot);
+// out must hold k entries; at most ANALYZER_SNAPSHOT_MAX_ENTRIES are copied
+int analyzer_snapshot_top(const AnalyzerSnapshot *snapshot, AnalyzerSnapshotEntry *out, int k, uint64_t *cycle);
+int analyzer_snapshot_is_live(const AnalyzerSnapshot *snapshot, int max_age_seconds);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -45,3 +45,49 @@ float calculate_std_dev(float *values, int count, float mean) {
     
     return sqrt(sum_sq_diff / (count - 1));
 }
+
+// Look up "key = value" under [section] in an ini file. Returns 1 if found.
+int read_config_value(const char *path, const char *section, const char *key, char *value, int size) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) return 0;
+    
+    char line[512];
+    int in_section = 0;
+    int found = 0;
+    
+    while (fgets(line, sizeof(line), fp)) {
+        trim_string(line);
+        char *p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        
+        if (*p == '\0' || *p == ';' || *p == '#') continue;
+        
+        if (*p == '[') {
+            char *end = strchr(p, ']');
+            if (end) {
+                *end = '\0';
+                in_section = strcmp(p + 1, section) == 0;
+            }
+            continue;
+        }
+        
+        if (!in_section) continue;
+        
+        char *eq = strchr(p, '=');
+        if (!eq) continue;
+        
+        *eq = '\0';
+        trim_string(p);
+        if (strcmp(p, key) != 0) continue;
+        
+        char *v = eq + 1;
+        while (*v == ' ' || *v == '\t') v++;
+        strncpy(value, v, size - 1);
+        value[size - 1] = '\0';
+        found = 1;
+        break;
+    }
+    
+    fclose(fp);
+    return found;
+}
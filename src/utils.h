@@ -39,5 +39,6 @@ void get_timestamp(char *buffer, int size);
 void trim_string(char *str);
 float calculate_average(float *values, int count);
 float calculate_std_dev(float *values, int count, float mean);
+int read_config_value(const char *path, const char *section, const char *key, char *value, int size);
 
 #endif